@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Compare JSON and CBOR responses from the device's high-rate endpoints.
+
+For each endpoint and encoding this reports the mean payload size, the mean
+server-side encode time taken from the Server-Timing header, and the mean
+round trip as seen from this host.
+
+    ./bench_encoding.py --host mitsusplit.local --count 50
+
+Use --scheme https (and --cacert) against firmware built with CONFIG_APP_HTTPS.
+Every request opens a new connection, so there the round trip includes a
+full TLS handshake.
+"""
+import argparse
+import re
+import ssl
+import statistics
+import time
+import urllib.request
+
+ENDPOINTS = ['/api/v1/temp/raw', '/api/v1/wifi/scan', '/api/v1/system/info']
+ENCODINGS = {
+    'json': 'application/json',
+    'cbor': 'application/cbor',
+}
+SERVER_TIMING = re.compile(r'enc;dur=([0-9.]+)')
+
+
+def tls_context(cacert):
+    """Verify against the certificate from ./do certs, or not at all without one, as bench_tls.py."""
+    context = ssl.create_default_context(cafile=cacert)
+    if not cacert:
+        context.check_hostname = False
+        context.verify_mode = ssl.CERT_NONE
+    return context
+
+
+def fetch(url, accept, context=None):
+    request = urllib.request.Request(url, headers={'Accept': accept})
+    start = time.perf_counter()
+    with urllib.request.urlopen(request, timeout=10, context=context) as response:
+        body = response.read()
+        content_type = response.headers.get('Content-Type', '')
+        timing = SERVER_TIMING.search(response.headers.get('Server-Timing', ''))
+    elapsed_ms = (time.perf_counter() - start) * 1000
+    if not content_type.startswith(accept):
+        raise RuntimeError(f'{url}: asked for {accept}, got {content_type}')
+    return len(body), float(timing.group(1)) if timing else None, elapsed_ms
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--host', default='mitsusplit.local')
+    parser.add_argument('--scheme', choices=('http', 'https'), default='http',
+                        help='https for firmware built with CONFIG_APP_HTTPS')
+    parser.add_argument('--cacert', help='the certificate from ./do certs; omit to skip verification')
+    parser.add_argument('--count', type=int, default=20, help='requests per endpoint and encoding')
+    args = parser.parse_args()
+    context = tls_context(args.cacert) if args.scheme == 'https' else None
+
+    print(f'{"endpoint":<22}{"enc":<6}{"bytes":>8}{"server ms":>12}{"rtt ms":>10}')
+    for endpoint in ENDPOINTS:
+        for name, accept in ENCODINGS.items():
+            sizes, server, rtt = [], [], []
+            for _ in range(args.count):
+                size, encode_ms, elapsed_ms = fetch(f'{args.scheme}://{args.host}{endpoint}', accept, context)
+                sizes.append(size)
+                rtt.append(elapsed_ms)
+                if encode_ms is not None:
+                    server.append(encode_ms)
+            server_ms = f'{statistics.mean(server):.3f}' if server else 'n/a'
+            print(f'{endpoint:<22}{name:<6}{statistics.mean(sizes):>8.0f}{server_ms:>12}{statistics.mean(rtt):>10.1f}')
+
+
+if __name__ == '__main__':
+    main()
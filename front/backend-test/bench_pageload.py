@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Time page loads of both front-ends against the device simulator.
+
+Each front-end's built dist/ is served by server.py with its default
+ESP32-like latency and bandwidth, or a --config override, and loaded
+repeatedly, each time in a fresh headless Chromium context so nothing is
+cached. For every load this records first byte, DOMContentLoaded, load, and
+time to interactive. Interactive here means the app has mounted and rendered
+the data from its first API call, checked with each front-end's 'ready'
+expression. web-provision makes no API call until asked to, so for it the
+benchmark clicks the front-end's 'click' selector once the page has loaded,
+and the time includes that interaction. Requires Playwright (pip install
+playwright; playwright install chromium).
+
+    ./bench_pageload.py --runs 10 --config slow-ap.json
+"""
+import argparse
+import os
+import socket
+import statistics
+import subprocess
+import sys
+import time
+import urllib.request
+
+from playwright.sync_api import sync_playwright
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+FRONT_ENDS = {
+    'web-provision': {
+        'dist': os.path.join(HERE, '..', 'web-provision', 'dist'),
+        # Scanning starts on this button, with the first poll 500 ms later
+        'click': 'text=Search for Networks',
+        # The placeholder network has a positive rssi, scanned ones negative
+        'ready': "[...document.querySelectorAll('.pure-menu-list label')].some(label => /-\\d/.test(label.textContent))",
+    },
+    'web-demo': {
+        'dist': os.path.join(HERE, '..', 'web-demo', 'dist'),
+        # Home fills in the IDF version from /api/v1/system/info
+        'ready': "/IDF version: \\S/.test(document.body.innerText)",
+    },
+}
+
+NAVIGATION_TIMING = """() => {
+    const nav = performance.getEntriesByType('navigation')[0];
+    return { ttfb: nav.responseStart, dcl: nav.domContentLoadedEventEnd, load: nav.loadEventEnd };
+}"""
+
+
+def free_port():
+    with socket.socket() as sock:
+        sock.bind(('127.0.0.1', 0))
+        return sock.getsockname()[1]
+
+
+def start_simulator(dist, config):
+    port = free_port()
+    command = [sys.executable, os.path.join(HERE, 'server.py'), '--site', dist, '--port', str(port)]
+    if config:
+        command += ['--config', config]
+    simulator = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    url = f'http://127.0.0.1:{port}/'
+    deadline = time.monotonic() + 10
+    while True:
+        try:
+            urllib.request.urlopen(url + 'favicon.ico', timeout=1).read()
+            return simulator, url
+        except OSError:
+            if time.monotonic() > deadline or simulator.poll() is not None:
+                simulator.kill()
+                raise RuntimeError(f'simulator for {dist} did not start')
+            time.sleep(0.2)
+
+
+def measure(browser, url, front_end):
+    context = browser.new_context()
+    page = context.new_page()
+    page.goto(url)
+    if 'click' in front_end:
+        page.click(front_end['click'])
+    page.wait_for_function(front_end['ready'], timeout=30000, polling='raf')
+    interactive = page.evaluate('performance.now()')
+    timing = page.evaluate(NAVIGATION_TIMING)
+    context.close()
+    return dict(timing, tti=interactive)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--runs', type=int, default=5, help='page loads per front-end')
+    parser.add_argument('--config', help='simulator config, as for server.py --config')
+    args = parser.parse_args()
+
+    print(f'{"front-end":<16}{"ttfb ms":>10}{"dcl ms":>10}{"load ms":>10}{"tti ms":>10}')
+    with sync_playwright() as playwright:
+        browser = playwright.chromium.launch()
+        for name, front_end in FRONT_ENDS.items():
+            if not os.path.isfile(os.path.join(front_end['dist'], 'index.html')):
+                print(f'{name:<16}not built, run npm run build in {os.path.dirname(front_end["dist"])}')
+                continue
+            simulator, url = start_simulator(front_end['dist'], args.config)
+            try:
+                runs = [measure(browser, url, front_end) for _ in range(args.runs)]
+            finally:
+                simulator.terminate()
+                simulator.wait()
+            mean = {key: statistics.mean(run[key] for run in runs) for key in runs[0]}
+            print(f'{name:<16}{mean["ttfb"]:>10.0f}{mean["dcl"]:>10.0f}{mean["load"]:>10.0f}{mean["tti"]:>10.0f}')
+        browser.close()
+
+
+if __name__ == '__main__':
+    main()
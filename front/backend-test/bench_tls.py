@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Compare request latency over plain HTTP, full TLS and resumed TLS.
+
+Each sample opens a new connection and makes a single GET, so connection
+setup is included in the time:
+
+  http     plain TCP, against a device built without CONFIG_APP_HTTPS
+           (only measured when --plain-host is given)
+  full     TLS without a session to resume, so a full ECDHE-ECDSA handshake
+  resumed  TLS offering the ticket from the previous connection
+  reused   requests on one kept-open TLS connection, the steady state
+
+The device's own handshake counters and timings from /api/v1/system/tls are
+shown next to the client-side numbers.
+
+    ./bench_tls.py --host mitsusplit.local --cacert ../../main/certs/servercert.pem
+"""
+import argparse
+import json
+import socket
+import ssl
+import statistics
+import time
+
+PATH = '/api/v1/temp/raw'
+
+
+def http_get(sock, host, path, keep_alive=False):
+    connection = 'keep-alive' if keep_alive else 'close'
+    sock.sendall(f'GET {path} HTTP/1.1\r\nHost: {host}\r\nConnection: {connection}\r\n\r\n'.encode())
+    reader = sock.makefile('rb')
+    status = reader.readline()
+    length = 0
+    while True:
+        line = reader.readline()
+        if line in (b'\r\n', b''):
+            break
+        name, _, value = line.decode().partition(':')
+        if name.lower() == 'content-length':
+            length = int(value)
+    body = reader.read(length)
+    if b' 200 ' not in status:
+        raise RuntimeError(f'{path}: {status.decode().strip()}')
+    return body
+
+
+def timed(fn):
+    start = time.perf_counter()
+    result = fn()
+    return (time.perf_counter() - start) * 1000, result
+
+
+def plain_request(host, port):
+    with socket.create_connection((host, port), timeout=10) as sock:
+        http_get(sock, host, PATH)
+
+
+def tls_request(context, host, port, session=None, path=PATH):
+    with socket.create_connection((host, port), timeout=10) as raw:
+        with context.wrap_socket(raw, server_hostname=host, session=session) as sock:
+            body = http_get(sock, host, path)
+            return sock.session, sock.session_reused, body
+
+
+def summarize(name, samples):
+    print(f'{name:<9}{len(samples):>6}{statistics.mean(samples):>10.1f}'
+          f'{statistics.median(samples):>10.1f}{max(samples):>10.1f}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--host', default='mitsusplit.local', help='device built with CONFIG_APP_HTTPS')
+    parser.add_argument('--port', type=int, default=443)
+    parser.add_argument('--plain-host', help='device built without CONFIG_APP_HTTPS')
+    parser.add_argument('--plain-port', type=int, default=80)
+    parser.add_argument('--cacert', help='the certificate from ./do certs; omit to skip verification')
+    parser.add_argument('--count', type=int, default=20)
+    args = parser.parse_args()
+
+    context = ssl.create_default_context(cafile=args.cacert)
+    if not args.cacert:
+        context.check_hostname = False
+        context.verify_mode = ssl.CERT_NONE
+    # The device speaks TLS 1.2, where the ticket is available straight after the handshake
+    context.maximum_version = ssl.TLSVersion.TLSv1_2
+
+    _, _, before = tls_request(context, args.host, args.port, path='/api/v1/system/tls')
+
+    print(f'{"mode":<9}{"n":>6}{"mean ms":>10}{"median":>10}{"max":>10}')
+    if args.plain_host:
+        summarize('http', [timed(lambda: plain_request(args.plain_host, args.plain_port))[0]
+                           for _ in range(args.count)])
+
+    full, resumed = [], []
+    not_resumed = 0
+    for _ in range(args.count):
+        elapsed, (session, _, _) = timed(lambda: tls_request(context, args.host, args.port))
+        full.append(elapsed)
+        elapsed, (_, reused, _) = timed(lambda: tls_request(context, args.host, args.port, session))
+        if reused:
+            resumed.append(elapsed)
+        else:
+            not_resumed += 1
+    summarize('full', full)
+    if resumed:
+        summarize('resumed', resumed)
+    if not_resumed:
+        print(f'warning: {not_resumed} of {args.count} resumption attempts fell back to a full handshake')
+
+    with socket.create_connection((args.host, args.port), timeout=10) as raw:
+        with context.wrap_socket(raw, server_hostname=args.host) as sock:
+            http_get(sock, args.host, PATH, keep_alive=True)
+            summarize('reused', [timed(lambda: http_get(sock, args.host, PATH, keep_alive=True))[0]
+                                 for _ in range(args.count)])
+
+    _, _, after = tls_request(context, args.host, args.port, path='/api/v1/system/tls')
+    before, after = json.loads(before), json.loads(after)
+    for kind in ('full', 'resumed'):
+        print(f'device {kind:<8} handshakes: {after[kind]["count"] - before[kind]["count"]:>4} '
+              f'(lifetime mean {after[kind]["mean_ms"]} ms, max {after[kind]["max_ms"]} ms)')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""Check that serving a scripted request mix doesn't allocate from our code.
+
+Needs firmware built with CONFIG_APP_HEAP_AUDIT. The mix runs once to warm
+up lazily initialised state, then again with heap tracing running. Each
+recorded allocation is mapped back to source with addr2line. The audit fails
+if any allocation has a caller in main/; allocations made purely inside
+ESP-IDF (lwIP buffers, for instance) are listed but not counted. A call stack
+only proves an allocation isn't ours if it reaches one of ENTRY_POINTS, so the
+audit also fails on any stack that fills the whole trace depth without
+getting there, as main/ could be further up.
+
+    ./heap_audit.py --host mitsusplit.local --elf ../../build/mitsusplit.elf
+
+Use --scheme https (and --cacert) against firmware built with CONFIG_APP_HTTPS.
+"""
+import argparse
+import json
+import ssl
+import subprocess
+import sys
+import urllib.request
+
+# (method, path, accept, body)
+REQUEST_MIX = [
+    ('GET', '/api/v1/system/info', 'application/json', None),
+    ('GET', '/api/v1/system/info', 'application/cbor', None),
+    ('GET', '/api/v1/temp/raw', 'application/json', None),
+    ('GET', '/api/v1/temp/raw', 'application/cbor', None),
+    ('GET', '/api/v1/wifi/scan', 'application/json', None),
+    ('GET', '/api/v1/wifi/scan', 'application/cbor', None),
+    ('POST', '/api/v1/light/brightness', 'text/plain', {'red': 1, 'green': 2, 'blue': 3}),
+    ('GET', '/', 'text/html', None),
+]
+
+# ESP-IDF functions that only ever call into main/ from further down the
+# stack, through handlers and callbacks, so a trace reaching one of them
+# without passing through main/ was made by ESP-IDF itself
+ENTRY_POINTS = {
+    'httpd_uri', 'httpd_req_new', 'httpd_sess_process', 'httpd_server', 'httpd_thread',
+    'esp_event_loop_run', 'esp_event_loop_run_task',
+    'tcpip_thread', 'timer_task', 'prvIdleTask', 'vPortTaskWrapper',
+}
+NULL_ADDRESSES = ('0x0', '(nil)')
+
+
+def tls_context(cacert):
+    """Verify against the certificate from ./do certs, or not at all without one, as bench_tls.py."""
+    context = ssl.create_default_context(cafile=cacert)
+    if not cacert:
+        context.check_hostname = False
+        context.verify_mode = ssl.CERT_NONE
+    return context
+
+
+def request(base_url, context, method, path, accept='*/*', body=None):
+    data = json.dumps(body).encode() if body is not None else None
+    req = urllib.request.Request(f'{base_url}{path}', data=data, method=method,
+                                 headers={'Accept': accept, 'Content-Type': 'application/json'})
+    with urllib.request.urlopen(req, timeout=10, context=context) as response:
+        return response.read()
+
+
+def run_mix(base_url, context, rounds):
+    for _ in range(rounds):
+        for method, path, accept, body in REQUEST_MIX:
+            request(base_url, context, method, path, accept, body)
+
+
+def symbolize(addr2line, elf, addresses):
+    """Map each address to 'function at file:line' with one addr2line call."""
+    if not addresses:
+        return {}
+    output = subprocess.run([addr2line, '-f', '-e', elf] + addresses,
+                            check=True, capture_output=True, text=True).stdout.splitlines()
+    return {addr: f'{output[2 * i]} at {output[2 * i + 1]}' for i, addr in enumerate(addresses)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--host', default='mitsusplit.local')
+    parser.add_argument('--scheme', choices=('http', 'https'), default='http',
+                        help='https for firmware built with CONFIG_APP_HTTPS')
+    parser.add_argument('--cacert', help='the certificate from ./do certs; omit to skip verification')
+    parser.add_argument('--elf', default='build/mitsusplit.elf')
+    parser.add_argument('--addr2line', default='xtensa-esp32-elf-addr2line')
+    parser.add_argument('--rounds', type=int, default=3, help='times to run the request mix while tracing')
+    args = parser.parse_args()
+
+    base_url = f'{args.scheme}://{args.host}'
+    context = tls_context(args.cacert) if args.scheme == 'https' else None
+    run_mix(base_url, context, 1)
+    request(base_url, context, 'POST', '/api/v1/debug/heap/start')
+    run_mix(base_url, context, args.rounds)
+    trace = json.loads(request(base_url, context, 'POST', '/api/v1/debug/heap/stop'))
+
+    records = trace['records']
+    addresses = sorted({addr for record in records for addr in record['alloced_by'] if addr not in NULL_ADDRESSES})
+    symbols = symbolize(args.addr2line, args.elf, addresses)
+
+    ours = 0
+    truncated = 0
+    for record in records:
+        callers = [symbols.get(addr, addr) for addr in record['alloced_by'] if addr not in NULL_ADDRESSES]
+        in_app = any('/main/' in caller for caller in callers)
+        # A stack shorter than the trace depth was unwound all the way
+        complete = (len(callers) < len(record['alloced_by'])
+                    or any(caller.split(' at ')[0] in ENTRY_POINTS for caller in callers))
+        if in_app:
+            ours += 1
+            label = 'APP '
+        elif not complete:
+            truncated += 1
+            label = '??? '
+        else:
+            label = 'idf '
+        print(f'{label}{record["size"]:>6} B  ' + ' <- '.join(callers))
+
+    print(f'{trace["total_allocations"]} allocations over {args.rounds} rounds, {ours} from main/, '
+          f'{truncated} with truncated call stacks')
+    if truncated:
+        print('warning: some stacks were cut off before an ESP-IDF entry point, raise CONFIG_HEAP_TRACING_STACK_DEPTH')
+    if trace['overflowed']:
+        print('warning: trace buffer overflowed, raise CONFIG_APP_HEAP_AUDIT_RECORDS')
+    return 1 if ours or truncated or trace['overflowed'] else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -1,63 +1,370 @@
 #!./flask/bin/python
+"""Device simulator for front-end development and performance testing.
 
+Implements every endpoint start_rest_server() registers, and serves a built
+front-end in place of the www partition. Out of the box it answers about as
+fast as the ESP32 does rather than instantly: every response waits out a
+per-route latency, bodies move at a capped rate in each direction, requests
+are handled one at a time (esp_http_server has a single worker task) and
+connections beyond the device's socket limit are closed as soon as they're
+accepted, so the browser sees a network error as it would from the device.
+Idle keep-alive connections hold a socket just as they do there. Requests
+can also be made to fail at random.
+
+    ./server.py --site ../web-provision/dist --config slow-ap.json
+
+The config file is JSON and overrides any of DEFAULT_CONFIG's keys. Routes in
+latency_ms and error_rate are request paths, with '*' as the fallback.
+"""
 # Based on tutorial here:
 # https://blog.miguelgrinberg.com/post/designing-a-restful-api-with-python-and-flask
-from flask import Flask, request, jsonify, send_from_directory
+import argparse
+import hashlib
+import json
+import os
+import random
+import struct
+import threading
+import time
+
+from flask import Flask, Response, abort, g, jsonify, request, send_from_directory
+from werkzeug.serving import ThreadedWSGIServer, WSGIRequestHandler
 
 app = Flask(__name__)
 
+DEFAULT_CONFIG = {
+    # Time spent in each handler before it answers
+    'latency_ms': {
+        '*': 15,
+        '/api/v1/wifi/scan': 40,
+    },
+    # Body throughput in bytes per second, device to browser and browser to
+    # device. These are unmeasured defaults, not observed figures: replace
+    # them with kib_per_sec from /api/v1/system/ota on real hardware and the
+    # round trips reported by bench_encoding.py.
+    'bandwidth_down': 100 * 1024,
+    'bandwidth_up': 60 * 1024,
+    # Requests handled at once; esp_http_server has a single worker
+    'workers': 1,
+    # Open client connections, busy or idle, before new ones are closed on
+    # accept, as esp_http_server's max_open_sockets (CONFIG_LWIP_MAX_SOCKETS
+    # less the sockets the server keeps for itself)
+    'max_open_sockets': 7,
+    # Probability that a request fails outright, and the status it fails with
+    'error_rate': {
+        '*': 0.0,
+    },
+    'error_status': 500,
+    # X-OTA-Token the update endpoints expect, as CONFIG_APP_OTA_TOKEN
+    'ota_token': 'simulator',
+}
+
+config = dict(DEFAULT_CONFIG)
+site_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'web-provision', 'dist')
+
+worker_slots = threading.BoundedSemaphore(DEFAULT_CONFIG['workers'])
+
 networks = [
-    {
-        "ssid": "gemini",
-        "rssi": 88
-    }
+    {'ssid': 'gemini', 'bssid': bytes.fromhex('a4b1c2d3e4f5'), 'rssi': -48},
+    {'ssid': 'castor', 'bssid': bytes.fromhex('a4b1c2d3e4f6'), 'rssi': -63},
+    {'ssid': 'pollux', 'bssid': bytes.fromhex('0c8112af3390'), 'rssi': -77},
+    {'ssid': 'guest', 'bssid': bytes.fromhex('0c8112af3391'), 'rssi': -85},
 ]
 
-def send_from_dist(file):
-    app.logger.info('sending web-provision/dist/%s', file)
-    return send_from_directory('../web-provision/dist', file)
+
+def for_route(setting):
+    table = config[setting]
+    return table.get(request.path, table.get('*', 0))
+
+
+##### DEVICE BEHAVIOUR #####
+class DeviceRequestHandler(WSGIRequestHandler):
+    """Keeps connections open between requests, as the device does.
+
+    werkzeug's handler closes every connection after one response. That's
+    safe here because admit_request() reads each request body in full.
+    """
+    protocol_version = 'HTTP/1.1'
+
+    def send_header(self, keyword, value):
+        # close_connection already reflects what the client asked for
+        if keyword.lower() == 'connection' and value.lower() == 'close' and not self.close_connection:
+            return
+        super().send_header(keyword, value)
+
+
+class DeviceServer(ThreadedWSGIServer):
+    """Closes connections beyond max_open_sockets as soon as they're accepted."""
+
+    def __init__(self, host, port, wsgi_app, max_open_sockets):
+        super().__init__(host, port, wsgi_app, handler=DeviceRequestHandler)
+        self.max_open_sockets = max_open_sockets
+        self.open_sockets = set()
+        self.sockets_lock = threading.Lock()
+
+    def verify_request(self, sock, client_address):
+        with self.sockets_lock:
+            if len(self.open_sockets) >= self.max_open_sockets:
+                app.logger.warning('closing connection from %s, %d already open',
+                                   client_address[0], len(self.open_sockets))
+                return False
+            self.open_sockets.add(sock)
+        return True
+
+    def close_request(self, sock):
+        with self.sockets_lock:
+            self.open_sockets.discard(sock)
+        super().close_request(sock)
+
+
+@app.before_request
+def admit_request():
+    worker_slots.acquire()
+
+    released = False
+
+    def release():
+        nonlocal released
+        if not released:
+            released = True
+            worker_slots.release()
+    g.release = release
+
+    # The device reads the whole body before answering
+    body_len = request.content_length or 0
+    if body_len:
+        request.get_data()
+        time.sleep(body_len / config['bandwidth_up'])
+    time.sleep(for_route('latency_ms') / 1000)
+    if random.random() < for_route('error_rate'):
+        app.logger.info('injecting %d for %s', config['error_status'], request.path)
+        abort(config['error_status'])
+
+
+def throttled(data, rate):
+    # Roughly 50 ms worth of data per write
+    step = max(1, rate // 20)
+    for offset in range(0, len(data), step):
+        piece = data[offset:offset + step]
+        yield piece
+        time.sleep(len(piece) / rate)
+
+
+@app.after_request
+def throttle_response(response):
+    response.direct_passthrough = False
+    data = response.get_data()
+    response.response = throttled(data, config['bandwidth_down'])
+    response.headers['Content-Length'] = str(len(data))
+    release = g.get('release')
+    if release:
+        response.call_on_close(release)
+    return response
+
+
+@app.teardown_request
+def release_on_error(error):
+    release = g.get('release')
+    if error is not None and release:
+        release()
+
+
+##### ENCODING #####
+def cbor_head(major, value):
+    if value < 24:
+        return struct.pack('>B', major << 5 | value)
+    for info, fmt, limit in ((24, '>BB', 0xff), (25, '>BH', 0xffff), (26, '>BI', 0xffffffff)):
+        if value <= limit:
+            return struct.pack(fmt, major << 5 | info, value)
+    return struct.pack('>BQ', major << 5 | 27, value)
+
+
+def cbor_encode(value):
+    if value is None:
+        return b'\xf6'
+    if isinstance(value, bool):
+        return b'\xf5' if value else b'\xf4'
+    if isinstance(value, int):
+        return cbor_head(0, value) if value >= 0 else cbor_head(1, -1 - value)
+    if isinstance(value, float):
+        return struct.pack('>Bd', 0xfb, value)
+    if isinstance(value, bytes):
+        return cbor_head(2, len(value)) + value
+    if isinstance(value, str):
+        encoded = value.encode()
+        return cbor_head(3, len(encoded)) + encoded
+    if isinstance(value, (list, tuple)):
+        return cbor_head(4, len(value)) + b''.join(cbor_encode(item) for item in value)
+    if isinstance(value, dict):
+        return cbor_head(5, len(value)) + b''.join(cbor_encode(k) + cbor_encode(v) for k, v in value.items())
+    raise TypeError(f'cannot CBOR encode {type(value).__name__}')
+
+
+def bssid_str(value):
+    # JSON carries BSSIDs formatted, CBOR as their raw bytes, as on the device
+    if isinstance(value, bytes):
+        return ':'.join(f'{b:02X}' for b in value)
+    raise TypeError(f'cannot JSON encode {type(value).__name__}')
+
+
+def accept_quality(accept, media_type):
+    """The q-value Accept gives media_type, or -1 if it isn't listed, as rest_accept_quality()."""
+    for media_range in accept.split(','):
+        name, *params = [part.strip() for part in media_range.split(';')]
+        if name.lower() != media_type:
+            continue
+        quality = 1.0
+        for param in params:
+            key, _, value = param.partition('=')
+            if key.lower() == 'q':
+                try:
+                    quality = min(max(float(value), 0.0), 1.0)
+                except ValueError:
+                    quality = 0.0
+        return quality
+    return -1
+
+
+def negotiated(payload):
+    """Answer in CBOR or JSON according to the Accept header, as the device does."""
+    start = time.perf_counter()
+    accept = request.headers.get('Accept', '')
+    cbor_quality = accept_quality(accept, 'application/cbor')
+    if cbor_quality > 0 and cbor_quality >= accept_quality(accept, 'application/json'):
+        response = Response(cbor_encode(payload), mimetype='application/cbor')
+    else:
+        response = Response(json.dumps(payload, indent='\t', default=bssid_str), mimetype='application/json')
+    response.headers['Vary'] = 'Accept'
+    response.headers['Server-Timing'] = f'enc;dur={(time.perf_counter() - start) * 1000:.3f}'
+    return response
+
+
+def json_body(*keys):
+    body = request.get_json(silent=True)
+    if not body or any(key not in body for key in keys):
+        abort(400)
+    return body
+
 
 ##### REST API #####
 @app.route('/api/v1/wifi/connect', methods=['POST'])
-def post_wifi_connect(args):
-    if not request.json or not 'ssid' in request.json or 'psk' not in request.json:
-        abort(400)
-    network = {
-        'ssid': request.json['ssid'],
-        'psk': request.json['psk'],
-    }
-    app.logger.info('wifi connect requested for %s', {"network": network})
-    return jsonify({'network': network}), 201
+def post_wifi_connect():
+    body = json_body('ssid', 'psk')
+    app.logger.info('wifi connect requested for ssid %s', body['ssid'])
+    return 'Post control value successfully'
+
 
 @app.route('/api/v1/wifi/scan', methods=['GET'])
 def get_wifi_scan():
-    app.logger.info('wifi scan returning %s', {"networks": networks})
-    return jsonify({"networks": networks}), 201
+    return negotiated({
+        'total_networks': len(networks),
+        'returned_networks': len(networks),
+        'networks': [dict(network, rssi=network['rssi'] + random.randint(-3, 3)) for network in networks],
+    })
+
+
+@app.route('/api/v1/system/info', methods=['GET'])
+def get_system_info():
+    return negotiated({'version': 'v5.2.1', 'cores': 2})
+
+
+@app.route('/api/v1/temp/raw', methods=['GET'])
+def get_temp_raw():
+    return negotiated({'raw': random.randrange(20)})
+
+
+@app.route('/api/v1/light/brightness', methods=['POST'])
+def post_light_brightness():
+    body = json_body('red', 'green', 'blue')
+    app.logger.info('Light control: red = %s, green = %s, blue = %s', body['red'], body['green'], body['blue'])
+    return 'Post control value successfully'
+
+
+def receive_image(partition):
+    start = time.perf_counter()
+    if request.headers.get('X-OTA-Token') != config['ota_token']:
+        abort(401)
+    image = request.get_data()
+    expected = request.headers.get('X-SHA256')
+    if not image:
+        abort(400)
+    if expected and expected.lower() != hashlib.sha256(image).hexdigest():
+        abort(400)
+    elapsed = time.perf_counter() - start + len(image) / config['bandwidth_up']
+    return jsonify({
+        'partition': partition,
+        'bytes': len(image),
+        'elapsed_ms': int(elapsed * 1000),
+        'kib_per_sec': len(image) / 1024 / elapsed if elapsed else 0,
+    })
+
+
+@app.route('/api/v1/system/ota', methods=['POST'])
+def post_system_ota():
+    return receive_image('ota_1')
+
+
+@app.route('/api/v1/system/ota/www', methods=['POST'])
+def post_system_ota_www():
+    return receive_image('www')
+
+
+@app.route('/api/v1/system/tls', methods=['GET'])
+def get_system_tls():
+    # The simulator only speaks plain HTTP, so there are never any handshakes
+    idle = {'count': 0, 'mean_ms': 0, 'max_ms': 0}
+    return jsonify({'full': idle, 'resumed': idle})
+
+
+@app.route('/api/v1/debug/heap/start', methods=['POST'])
+def post_heap_start():
+    return 'Heap tracing started'
+
+
+@app.route('/api/v1/debug/heap/stop', methods=['POST'])
+def post_heap_stop():
+    return jsonify({'total_allocations': 0, 'overflowed': False, 'records': []})
+
 
 ##### SITE CONTENT #####
+def send_from_dist(file):
+    app.logger.info('sending %s/%s', site_dir, file)
+    if not os.path.isfile(os.path.join(site_dir, file)):
+        # rest_common_get_handler answers a missing file with a 500
+        abort(500)
+    return send_from_directory(site_dir, file, max_age=0)
+
+
 @app.route('/')
 def root():
     return send_from_dist('index.html')
 
-@app.route('/index.html')
-def index():
-    return send_from_dist(request.path[1:]);
 
-@app.route('/favicon.ico')
-def favicon():
-    return send_from_dist(request.path[1:]);
+@app.route('/<path:file>')
+def site_file(file):
+    return send_from_dist(file)
+
 
-@app.route('/axios.min.js')
-def axios_js():
-    return send_from_dist(request.path[1:]);
+def main():
+    global config, site_dir, worker_slots
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--site', default=site_dir, help='built front-end to serve')
+    parser.add_argument('--config', help='JSON file overriding DEFAULT_CONFIG')
+    parser.add_argument('--host', default='127.0.0.1')
+    parser.add_argument('--port', type=int, default=5000)
+    parser.add_argument('--debug', action='store_true')
+    args = parser.parse_args()
 
-@app.route('/petite-vue.min.js')
-def petite_vue_js():
-    return send_from_dist(request.path[1:]);
+    if args.config:
+        with open(args.config) as f:
+            config.update(json.load(f))
+    site_dir = os.path.abspath(args.site)
+    worker_slots = threading.BoundedSemaphore(config['workers'])
+    app.debug = args.debug
+    server = DeviceServer(args.host, args.port, app, config['max_open_sockets'])
+    print(f'Serving {site_dir} on http://{args.host}:{args.port}')
+    server.serve_forever()
 
-@app.route('/pure-min.css')
-def pure_css():
-    return send_from_dist(request.path[1:]);
 
 if __name__ == '__main__':
-    app.run(debug=True)
+    main()
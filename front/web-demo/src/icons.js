@@ -0,0 +1,21 @@
+// The handful of Material Design icons the app uses, as inline SVG, so the
+// page doesn't have to fetch the Material Icons font from Google
+function svgIcon (path) {
+  return {
+    functional: true,
+    render (h) {
+      return h('svg', {
+        attrs: { viewBox: '0 0 24 24', width: 24, height: 24, fill: 'currentColor' }
+      }, [h('path', { attrs: { d: path } })])
+    }
+  }
+}
+
+export default {
+  home: { component: svgIcon('M10 20v-6h4v6h5v-8h3L12 3 2 12h3v8z') },
+  show_chart: { component: svgIcon('M3.5 18.49l6-6.01 4 4L22 6.92l-1.41-1.41-7.09 7.97-4-4L2 16.99z') },
+  highlight: { component: svgIcon('M6 14l3 3v5h6v-5l3-3V9H6zm5-12h2v3h-2zM3.5 5.88l1.41-1.42 2.12 2.12L5.62 8zm13.46.71l2.12-2.12 1.42 1.41L18.38 8z') },
+  check_box: { component: svgIcon('M19 3H5c-1.11 0-2 .9-2 2v14c0 1.1.89 2 2 2h14c1.11 0 2-.9 2-2V5c0-1.1-.89-2-2-2zm-9 14l-5-5 1.41-1.41L10 14.17l7.59-7.59L19 8l-9 9z') },
+  // Used by v-toolbar-side-icon
+  menu: { component: svgIcon('M3 18h18v-2H3v2zm0-5h18v-2H3v2zm0-7v2h18V6H3z') }
+}
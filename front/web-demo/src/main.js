@@ -2,12 +2,39 @@ import Vue from 'vue'
 import './plugins/vuetify'
 import App from './App.vue'
 import router from './router'
-import axios from 'axios'
 import store from './store'
+// Shared with web-provision, whose firmware build is what gets tested most
+import { CBOR_CONTENT_TYPE, decodeCbor } from '../../web-provision/src/cbor'
 
 Vue.config.productionTip = false
 
-Vue.prototype.$ajax = axios
+// Thin wrapper over fetch, in place of pulling axios into the bundle
+Vue.prototype.$ajax = {
+  request(method, url, body) {
+    // Prefer the device's compact CBOR encoding, falling back to JSON
+    const init = { method, headers: { Accept: `${CBOR_CONTENT_TYPE}, application/json;q=0.9` } }
+    if (body !== undefined) {
+      init.headers['Content-Type'] = 'application/json'
+      init.body = JSON.stringify(body)
+    }
+    return fetch(url, init).then(response => {
+      if (!response.ok) {
+        throw new Error(`${response.status} ${response.statusText}`)
+      }
+      const type = response.headers.get('Content-Type') || ''
+      const data = type.startsWith(CBOR_CONTENT_TYPE)
+        ? response.arrayBuffer().then(decodeCbor)
+        : response.json().catch(() => null)
+      return data.then(data => ({ data, status: response.status }))
+    })
+  },
+  get(url) {
+    return this.request('GET', url)
+  },
+  post(url, body) {
+    return this.request('POST', url, body)
+  }
+}
 
 new Vue({
   router,
@@ -1,6 +1,5 @@
 import Vue from 'vue'
 import Vuex from 'vuex'
-import axios from 'axios'
 
 Vue.use(Vuex)
 
@@ -16,7 +15,7 @@ export default new Vuex.Store({
   },
   actions: {
     update_chart_value({ commit }) {
-      axios.get("/api/v1/temp/raw")
+      Vue.prototype.$ajax.get("/api/v1/temp/raw")
         .then(data => {
           commit("update_chart_value", data.data.raw);
         })
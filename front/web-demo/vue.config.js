@@ -1,4 +1,6 @@
 module.exports = {
+  // Source maps would be packed into the www partition along with the app
+  productionSourceMap: false,
   devServer: {
     proxy: {
       '/api': {
@@ -0,0 +1,85 @@
+// Build the provisioning UI into dist/ as a single self-contained index.html.
+//
+// The page has to load from the device's own softAP with no internet access,
+// and every byte of it lives in the www SPIFFS partition, so the script is
+// bundled and minified with its dependencies, Pure CSS is cut down to the
+// selectors the page actually uses, and both are inlined into the markup to
+// save the extra round trips to the ESP32's small HTTP server.
+import { build, transform } from 'esbuild'
+import { PurgeCSS } from 'purgecss'
+import { copyFile, mkdir, readFile, readdir, rm, stat, writeFile } from 'node:fs/promises'
+import { createRequire } from 'node:module'
+import { fileURLToPath } from 'node:url'
+import { gzipSync } from 'node:zlib'
+
+const require = createRequire(import.meta.url)
+const srcDir = fileURLToPath(new URL('./src/', import.meta.url))
+const distDir = fileURLToPath(new URL('./dist/', import.meta.url))
+
+// Browsers seen on phones and laptops doing provisioning
+const TARGET = ['es2020', 'chrome90', 'firefox90', 'safari14']
+
+async function bundleScript () {
+  const result = await build({
+    entryPoints: [srcDir + 'app.js'],
+    bundle: true,
+    minify: true,
+    treeShaking: true,
+    format: 'iife',
+    target: TARGET,
+    legalComments: 'none',
+    write: false
+  })
+  return result.outputFiles[0].text
+}
+
+async function purgeStyles (markup, script) {
+  const [purged] = await new PurgeCSS().purge({
+    content: [
+      { raw: markup, extension: 'html' },
+      { raw: script, extension: 'js' }
+    ],
+    css: [require.resolve('purecss/build/pure-min.css')]
+  })
+  const result = await transform(purged.css, { loader: 'css', minify: true, target: TARGET })
+  return result.code
+}
+
+// Whitespace runs are collapsed rather than removed, as it's significant
+// between the inline-block buttons and labels
+function minifyMarkup (markup) {
+  return markup
+    .replace(/<!--(?!\s*inline:)[\s\S]*?-->/g, '')
+    .replace(/\s+/g, ' ')
+    .trim()
+}
+
+async function main () {
+  const markup = await readFile(srcDir + 'index.html', 'utf8')
+  const script = await bundleScript()
+  const styles = await purgeStyles(markup, script)
+
+  // Function replacers, so that '$' sequences in the minified code are left alone
+  const page = minifyMarkup(markup)
+    .replace(/<!--\s*inline:css\s*-->/, () => `<style>${styles}</style>`)
+    .replace(/<!--\s*inline:js\s*-->/, () => `<script>${script.replace(/<\/script/gi, '<\\/script')}</script>`)
+
+  await rm(distDir, { recursive: true, force: true })
+  await mkdir(distDir, { recursive: true })
+  await writeFile(distDir + 'index.html', page)
+  await copyFile(srcDir + 'favicon.ico', distDir + 'favicon.ico')
+
+  let total = 0
+  for (const name of await readdir(distDir)) {
+    const { size } = await stat(distDir + name)
+    const gzipped = gzipSync(await readFile(distDir + name)).length
+    total += size
+    console.log(`${name.padEnd(16)} ${String(size).padStart(8)} B ${String(gzipped).padStart(8)} B gzip`)
+  }
+  console.log(`${'total'.padEnd(16)} ${String(total).padStart(8)} B`)
+}
+
+main().catch((error) => {
+  console.error(error)
+  process.exit(1)
+})
@@ -0,0 +1,76 @@
+import { createApp, reactive } from 'petite-vue'
+import { CBOR_CONTENT_TYPE, decodeCbor } from './cbor.js'
+
+// Fetch an API resource, preferring the device's compact CBOR encoding and
+// falling back to JSON from servers that don't offer it
+function fetchData(url) {
+  return fetch(url, { headers: { "Accept": CBOR_CONTENT_TYPE + ", application/json;q=0.9" } })
+    .then((response) => {
+      if (!response.ok) {
+        throw new Error(response.status + " " + response.statusText);
+      }
+      const type = response.headers.get("Content-Type") || "";
+      return type.startsWith(CBOR_CONTENT_TYPE) ? response.arrayBuffer().then(decodeCbor) : response.json();
+    });
+}
+
+// sort networks by signal strength
+function compareNetworkStrength(a, b) { return a.rssi - b.rssi; }
+function compareNetworkName(a, b) { if (a.ssid < b.ssid) { return -1 } else if (a.ssid > b.ssid) { return 1; } else { return 0; }}
+// reusable function that will return the network button
+function networkBtn(props){
+  return {
+    $template: "#network-btn",
+    ssid: props.ssid,
+    rssi: props.rssi,
+    size: props.size
+  }
+}
+// Create global data store
+const store = reactive({
+  networks: [{ "ssid": "gemini", "rssi": 88 }],
+  scanTimer: null,
+  get networksByStrength() {
+    return this.networks.toSorted(compareNetworkStrength);
+  },
+  get networksByName() {
+    return this.networks.toSorted(compareNetworkName);
+  },
+  startScan() {
+    if (this.scanTimer == null) {
+      this.scanTimer = setInterval(() => this.refreshNetworks(), 500);
+    }
+  },
+  stopScan() {
+    if (this.scanTimer != null) {
+      clearInterval(this.scanTimer);
+      this.scanTimer = null;
+    }
+  },
+  refreshNetworks() {
+    fetchData("/api/v1/wifi/scan")
+      .then((data) => {
+        this.networks = data.networks;
+      })
+      .catch(function (error) {
+        console.log(error);
+      });
+  },
+  connectToNetwork(ssid, password) {
+    fetch("/api/v1/wifi/connect", {
+      method: "POST",
+      headers: { "Content-Type": "application/json" },
+      body: JSON.stringify({
+        "ssid": ssid,
+        "psk": password,
+      }),
+    })
+      .then(function (response) {
+        console.log(response);
+      })
+      .catch(function (error) {
+        console.log(error);
+      });
+  },
+});
+createApp({ store, networkBtn }).mount()
@@ -0,0 +1,103 @@
+// Minimal CBOR (RFC 8949) decoder for the device's API responses.
+//
+// Handles the definite-length items the firmware's encoder emits, plus the
+// simple values and floats so that anything well-formed decodes. Byte strings
+// come back as Uint8Array, maps as plain objects.
+export const CBOR_CONTENT_TYPE = 'application/cbor'
+
+const textDecoder = new TextDecoder()
+
+export function decodeCbor (buffer) {
+  const view = new DataView(buffer)
+  let offset = 0
+
+  function readArgument (info) {
+    if (info < 24) {
+      return info
+    }
+    let value
+    switch (info) {
+      case 24: value = view.getUint8(offset); offset += 1; break
+      case 25: value = view.getUint16(offset); offset += 2; break
+      case 26: value = view.getUint32(offset); offset += 4; break
+      case 27: value = Number(view.getBigUint64(offset)); offset += 8; break
+      default: throw new Error('unsupported CBOR argument ' + info)
+    }
+    return value
+  }
+
+  function readItem () {
+    const initial = view.getUint8(offset++)
+    const major = initial >> 5
+    const info = initial & 0x1f
+    if (major === 7) {
+      return readSimple(info)
+    }
+    const arg = readArgument(info)
+    switch (major) {
+      case 0: return arg
+      case 1: return -1 - arg
+      case 2: {
+        const bytes = new Uint8Array(buffer, offset, arg).slice()
+        offset += arg
+        return bytes
+      }
+      case 3: {
+        const text = textDecoder.decode(new Uint8Array(buffer, offset, arg))
+        offset += arg
+        return text
+      }
+      case 4: {
+        const items = new Array(arg)
+        for (let i = 0; i < arg; i++) {
+          items[i] = readItem()
+        }
+        return items
+      }
+      case 5: {
+        const map = {}
+        for (let i = 0; i < arg; i++) {
+          const key = readItem()
+          map[key] = readItem()
+        }
+        return map
+      }
+      default:
+        // Tags aren't used by the device; decode the tagged item as-is
+        return readItem()
+    }
+  }
+
+  function readSimple (info) {
+    let value
+    switch (info) {
+      case 20: return false
+      case 21: return true
+      case 22: return null
+      case 23: return undefined
+      case 25: value = readHalf(view.getUint16(offset)); offset += 2; return value
+      case 26: value = view.getFloat32(offset); offset += 4; return value
+      case 27: value = view.getFloat64(offset); offset += 8; return value
+      default: throw new Error('unsupported CBOR simple value ' + info)
+    }
+  }
+
+  const value = readItem()
+  if (offset !== buffer.byteLength) {
+    throw new Error('trailing bytes after CBOR item')
+  }
+  return value
+}
+
+function readHalf (half) {
+  const exponent = (half >> 10) & 0x1f
+  const mantissa = half & 0x3ff
+  const sign = half & 0x8000 ? -1 : 1
+  if (exponent === 0) {
+    return sign * mantissa * 2 ** -24
+  }
+  if (exponent === 0x1f) {
+    return mantissa ? NaN : sign * Infinity
+  }
+  return sign * (mantissa + 1024) * 2 ** (exponent - 25)
+}
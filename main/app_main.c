@@ -18,6 +18,7 @@
 #include "esp_netif.h"
 #include "esp_event.h"
 #include "esp_log.h"
+#include "esp_ota_ops.h"
 #include "mdns.h"
 #include "lwip/apps/netbiosns.h"
 #include "protocol_examples_common.h"
@@ -41,8 +42,13 @@ static void initialise_mdns(void)
         {"path", "/"}
     };
 
+#if CONFIG_APP_HTTPS
+    ESP_ERROR_CHECK(mdns_service_add("ESP32-WebServer", "_https", "_tcp", 443, serviceTxtData,
+                                     sizeof(serviceTxtData) / sizeof(serviceTxtData[0])));
+#else
     ESP_ERROR_CHECK(mdns_service_add("ESP32-WebServer", "_http", "_tcp", 80, serviceTxtData,
                                      sizeof(serviceTxtData) / sizeof(serviceTxtData[0])));
+#endif
 }
 
 esp_err_t init_fs(void)
@@ -100,6 +106,17 @@ void app_main(void)
     ESP_LOGI(TAG, "starting wifi softAP mode...");
     ESP_ERROR_CHECK(wifi_softap_init());
     ESP_LOGI(TAG, "starting web server...");
-    ESP_ERROR_CHECK(init_fs());
+    if (init_fs() != ESP_OK) {
+        // A www update cut short leaves the partition unmountable. The API
+        // still comes up so that /api/v1/system/ota/www can replace it.
+        ESP_LOGE(TAG, "Web interface unavailable, starting the API without it");
+    }
     ESP_ERROR_CHECK(start_rest_server(CONFIG_WEB_MOUNT_POINT));
+
+    // Having come up far enough to accept another update, keep this image
+    // rather than letting the bootloader roll back to the previous slot
+    ret = esp_ota_mark_app_valid_cancel_rollback();
+    if (ret != ESP_OK && ret != ESP_ERR_NOT_SUPPORTED) {
+        ESP_LOGW(TAG, "Failed to cancel OTA rollback (%s)", esp_err_to_name(ret));
+    }
 }
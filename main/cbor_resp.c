@@ -0,0 +1,153 @@
+/* Streaming CBOR encoder for HTTP responses
+
+   This code is in the Public Domain (or CC0 licensed, at your option.)
+
+   Unless required by applicable law or agreed to in writing, this
+   software is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+   CONDITIONS OF ANY KIND, either express or implied.
+*/
+#include <string.h>
+#include "cbor_resp.h"
+
+/* CBOR major types, already shifted into the initial byte */
+#define CBOR_MAJOR_UINT   (0 << 5)
+#define CBOR_MAJOR_NEGINT (1 << 5)
+#define CBOR_MAJOR_BYTES  (2 << 5)
+#define CBOR_MAJOR_TEXT   (3 << 5)
+#define CBOR_MAJOR_ARRAY  (4 << 5)
+#define CBOR_MAJOR_MAP    (5 << 5)
+
+void cbor_resp_init(cbor_resp_t *enc, httpd_req_t *req, void *buf, size_t size)
+{
+    enc->req = req;
+    enc->buf = buf;
+    enc->size = size;
+    enc->len = 0;
+    enc->sent = 0;
+    enc->err = ESP_OK;
+    httpd_resp_set_type(req, CBOR_RESP_CONTENT_TYPE);
+}
+
+static void cbor_resp_flush(cbor_resp_t *enc)
+{
+    if (enc->err == ESP_OK && enc->len > 0) {
+        enc->err = httpd_resp_send_chunk(enc->req, (const char *)enc->buf, enc->len);
+        enc->sent += enc->len;
+    }
+    enc->len = 0;
+}
+
+static void cbor_resp_write(cbor_resp_t *enc, const void *data, size_t len)
+{
+    const uint8_t *src = data;
+    while (enc->err == ESP_OK && len > 0) {
+        if (enc->len == enc->size) {
+            cbor_resp_flush(enc);
+        }
+        size_t n = enc->size - enc->len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(enc->buf + enc->len, src, n);
+        enc->len += n;
+        src += n;
+        len -= n;
+    }
+}
+
+/* Encode an item head: major type plus the shortest argument that holds `value` */
+static void cbor_resp_head(cbor_resp_t *enc, uint8_t major, uint64_t value)
+{
+    uint8_t head[9];
+    size_t len;
+    if (value < 24) {
+        head[0] = major | value;
+        len = 1;
+    } else if (value <= UINT8_MAX) {
+        head[0] = major | 24;
+        head[1] = value;
+        len = 2;
+    } else if (value <= UINT16_MAX) {
+        head[0] = major | 25;
+        head[1] = value >> 8;
+        head[2] = value;
+        len = 3;
+    } else if (value <= UINT32_MAX) {
+        head[0] = major | 26;
+        for (int i = 0; i < 4; i++) {
+            head[1 + i] = value >> (24 - 8 * i);
+        }
+        len = 5;
+    } else {
+        head[0] = major | 27;
+        for (int i = 0; i < 8; i++) {
+            head[1 + i] = value >> (56 - 8 * i);
+        }
+        len = 9;
+    }
+    cbor_resp_write(enc, head, len);
+}
+
+void cbor_resp_uint(cbor_resp_t *enc, uint64_t value)
+{
+    cbor_resp_head(enc, CBOR_MAJOR_UINT, value);
+}
+
+void cbor_resp_int(cbor_resp_t *enc, int64_t value)
+{
+    if (value < 0) {
+        /* Negative integers carry -1 - n, which can't overflow */
+        cbor_resp_head(enc, CBOR_MAJOR_NEGINT, (uint64_t)(-1 - value));
+    } else {
+        cbor_resp_head(enc, CBOR_MAJOR_UINT, (uint64_t)value);
+    }
+}
+
+void cbor_resp_bytes(cbor_resp_t *enc, const void *data, size_t len)
+{
+    cbor_resp_head(enc, CBOR_MAJOR_BYTES, len);
+    cbor_resp_write(enc, data, len);
+}
+
+void cbor_resp_text(cbor_resp_t *enc, const char *str)
+{
+    size_t len = strlen(str);
+    cbor_resp_head(enc, CBOR_MAJOR_TEXT, len);
+    cbor_resp_write(enc, str, len);
+}
+
+void cbor_resp_array(cbor_resp_t *enc, size_t items)
+{
+    cbor_resp_head(enc, CBOR_MAJOR_ARRAY, items);
+}
+
+void cbor_resp_map(cbor_resp_t *enc, size_t pairs)
+{
+    cbor_resp_head(enc, CBOR_MAJOR_MAP, pairs);
+}
+
+int cbor_resp_unsent(const cbor_resp_t *enc)
+{
+    return enc->sent == 0;
+}
+
+esp_err_t cbor_resp_finish(cbor_resp_t *enc)
+{
+    if (enc->err != ESP_OK) {
+        /* Terminate whatever was already streamed */
+        if (enc->sent > 0) {
+            httpd_resp_send_chunk(enc->req, NULL, 0);
+        }
+        return enc->err;
+    }
+    if (enc->sent == 0) {
+        /* Everything fit in the buffer: send it whole, with a Content-Length */
+        enc->err = httpd_resp_send(enc->req, (const char *)enc->buf, enc->len);
+    } else {
+        cbor_resp_flush(enc);
+        if (enc->err == ESP_OK) {
+            enc->err = httpd_resp_send_chunk(enc->req, NULL, 0);
+        }
+    }
+    return enc->err;
+}
@@ -0,0 +1,39 @@
+#ifndef __cbor_resp_h__
+#define __cbor_resp_h__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+#define CBOR_RESP_CONTENT_TYPE "application/cbor"
+
+/* Streaming CBOR (RFC 8949) encoder writing straight into an HTTP response.
+ *
+ * Items are encoded into a caller-supplied buffer as they're added, with no
+ * intermediate tree. A response that fits in the buffer goes out as a single
+ * send with a Content-Length; a larger one is flushed as chunks whenever the
+ * buffer fills. Only definite-length containers are supported, so callers
+ * must know their element counts up front. The first error is latched in
+ * `err` and reported by cbor_resp_finish(). */
+typedef struct cbor_resp {
+    httpd_req_t *req;
+    uint8_t *buf;
+    size_t size;
+    size_t len;
+    size_t sent;
+    esp_err_t err;
+} cbor_resp_t;
+
+void cbor_resp_init(cbor_resp_t *enc, httpd_req_t *req, void *buf, size_t size);
+void cbor_resp_uint(cbor_resp_t *enc, uint64_t value);
+void cbor_resp_int(cbor_resp_t *enc, int64_t value);
+void cbor_resp_bytes(cbor_resp_t *enc, const void *data, size_t len);
+void cbor_resp_text(cbor_resp_t *enc, const char *str);
+void cbor_resp_array(cbor_resp_t *enc, size_t items);
+void cbor_resp_map(cbor_resp_t *enc, size_t pairs);
+/* True if nothing has been sent yet, so response headers can still be set */
+int cbor_resp_unsent(const cbor_resp_t *enc);
+esp_err_t cbor_resp_finish(cbor_resp_t *enc);
+
+#endif // __cbor_resp_h__
@@ -7,14 +7,33 @@
    CONDITIONS OF ANY KIND, either express or implied.
 */
 #include <string.h>
+#include <inttypes.h>
 #include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/param.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "esp_http_server.h"
+#if CONFIG_APP_HTTPS
+#include "esp_https_server.h"
+/* Private mbedtls header, for the handshake's session resumption flag */
+#include "ssl_misc.h"
+#endif
 #include "esp_chip_info.h"
 #include "esp_random.h"
 #include "esp_log.h"
 #include "esp_vfs.h"
+#include "esp_spiffs.h"
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include "esp_heap_trace.h"
+#include "spi_flash_mmap.h"
+#include "mbedtls/sha256.h"
+#include "mbedtls/constant_time.h"
 #include "cJSON.h"
 
+#include "cbor_resp.h"
 #include "wifi.h"
 
 #define DEFAULT_SCAN_LIST_SIZE CONFIG_ESP_WIFI_SCAN_LIST_SIZE
@@ -33,11 +52,106 @@ static const char *REST_TAG = "esp-rest";
 #define FILE_PATH_MAX (ESP_VFS_PATH_MAX + 128)
 #define SCRATCH_BUFSIZE (10240)
 
+/* Required request header carrying the shared CONFIG_APP_OTA_TOKEN */
+#define OTA_TOKEN_HDR "X-OTA-Token"
+/* Optional request header carrying the hex SHA-256 of an uploaded image */
+#define OTA_SHA256_HDR "X-SHA256"
+#define OTA_SHA256_LEN (32)
+/* Consecutive socket timeouts tolerated before an upload is abandoned */
+#define OTA_RECV_MAX_TIMEOUTS (5)
+#define OTA_WWW_PARTITION_LABEL "www"
+
+/* Enough of an Accept header to find the media types we negotiate on */
+#define ACCEPT_HDR_MAX (128)
+#define SERVER_TIMING_MAX (32)
+
+#if CONFIG_APP_OTA
+_Static_assert(sizeof(CONFIG_APP_OTA_TOKEN) > 1, "CONFIG_APP_OTA requires a non-empty CONFIG_APP_OTA_TOKEN");
+
+esp_err_t init_fs(void);
+#endif
+
 typedef struct rest_server_context {
     char base_path[ESP_VFS_PATH_MAX + 1];
     char scratch[SCRATCH_BUFSIZE];
+    wifi_ap_record_t ap_info[DEFAULT_SCAN_LIST_SIZE];
 } rest_server_context_t;
 
+#if CONFIG_APP_STATIC_ALLOCATION
+static rest_server_context_t s_rest_context;
+
+/* cJSON node pool. Handlers run one at a time on the httpd task and every
+ * tree is dropped before its handler returns, so a bump allocator that's
+ * rewound at the start of each request is all cJSON needs. */
+#define JSON_POOL_ALIGN(size) (((size) + 7) & ~7)
+/* Pool use of one wifi scan entry at most: an object and its three members,
+ * their copied keys, and the ssid and formatted bssid strings */
+#define JSON_POOL_AP_SIZE (4 * JSON_POOL_ALIGN(sizeof(cJSON))                    \
+                           + JSON_POOL_ALIGN(sizeof("ssid"))                       \
+                           + JSON_POOL_ALIGN(sizeof("bssid"))                      \
+                           + JSON_POOL_ALIGN(sizeof("rssi"))                       \
+                           + JSON_POOL_ALIGN(sizeof(((wifi_ap_record_t *)0)->ssid)) \
+                           + JSON_POOL_ALIGN(sizeof("00:00:00:00:00:00")))
+/* Grown past CONFIG_APP_JSON_POOL_SIZE if need be, so that a full scan
+ * response always fits, plus 1 KiB for its root object and counts */
+#define JSON_POOL_SIZE MAX(CONFIG_APP_JSON_POOL_SIZE, DEFAULT_SCAN_LIST_SIZE * JSON_POOL_AP_SIZE + 1024)
+
+static uint8_t s_json_pool[JSON_POOL_SIZE] __attribute__((aligned(8)));
+static size_t s_json_pool_used;
+
+static void *json_pool_malloc(size_t size)
+{
+    size = JSON_POOL_ALIGN(size);
+    if (size > sizeof(s_json_pool) - s_json_pool_used) {
+        ESP_LOGE(REST_TAG, "JSON pool exhausted (%u of %u bytes used)", s_json_pool_used, sizeof(s_json_pool));
+        return NULL;
+    }
+    void *ptr = &s_json_pool[s_json_pool_used];
+    s_json_pool_used += size;
+    return ptr;
+}
+
+static void json_pool_free(void *ptr)
+{
+    /* Reclaimed wholesale by rest_json_reset() */
+}
+
+static void rest_json_reset(void)
+{
+    s_json_pool_used = 0;
+}
+#else
+static void rest_json_reset(void)
+{
+}
+#endif
+
+#if CONFIG_APP_HEAP_AUDIT
+static heap_trace_record_t s_heap_records[CONFIG_APP_HEAP_AUDIT_RECORDS];
+#endif
+
+#if CONFIG_APP_HTTPS
+/* ECDSA certificate and key, generated by './do certs' and embedded at build time */
+extern const unsigned char servercert_pem_start[] asm("_binary_servercert_pem_start");
+extern const unsigned char servercert_pem_end[]   asm("_binary_servercert_pem_end");
+extern const unsigned char prvtkey_pem_start[] asm("_binary_prvtkey_pem_start");
+extern const unsigned char prvtkey_pem_end[]   asm("_binary_prvtkey_pem_end");
+
+typedef struct tls_handshake_stats {
+    uint32_t count;
+    int64_t total_us;
+    int64_t max_us;
+} tls_handshake_stats_t;
+
+/* Handshakes all run inside the httpd task's open callback, one at a time,
+ * so a single start timestamp, resumption flag and unlocked counters are
+ * enough. */
+static int64_t s_tls_handshake_start_us;
+static int s_tls_handshake_resumed;
+static tls_handshake_stats_t s_tls_full;
+static tls_handshake_stats_t s_tls_resumed;
+#endif
+
 #define CHECK_FILE_EXTENSION(filename, ext) (strcasecmp(&filename[strlen(filename) - strlen(ext)], ext) == 0)
 
 /* Set HTTP response content type according to file extension */
@@ -110,6 +224,91 @@ static esp_err_t rest_common_get_handler(httpd_req_t *req)
     return ESP_OK;
 }
 
+/* Parse an Accept header qvalue ("0", "0.5", "1.000", ...) into thousandths.
+ * Anything malformed counts as 0, which leaves the response as JSON. */
+static int rest_parse_qvalue(const char *q)
+{
+    if (*q != '0' && *q != '1') {
+        return 0;
+    }
+    int value = (*q++ == '1') ? 1000 : 0;
+    if (*q == '.') {
+        q++;
+        for (int scale = 100; scale > 0 && *q >= '0' && *q <= '9'; scale /= 10, q++) {
+            value += (*q - '0') * scale;
+        }
+    }
+    return MIN(value, 1000);
+}
+
+/* Quality, in thousandths, that an Accept header gives the media type `type`,
+ * or -1 if it isn't listed. Wildcard ranges aren't matched. */
+static int rest_accept_quality(const char *accept, const char *type)
+{
+    size_t type_len = strlen(type);
+    const char *range = accept;
+    while (*range) {
+        range += strspn(range, " \t,");
+        const char *end = range + strcspn(range, ",");
+        size_t name_len = strcspn(range, " \t;,");
+        if (name_len == type_len && strncasecmp(range, type, type_len) == 0) {
+            int quality = 1000;
+            for (const char *param = memchr(range, ';', end - range); param;
+                 param = memchr(param, ';', end - param)) {
+                param++;
+                param += strspn(param, " \t");
+                if ((param[0] == 'q' || param[0] == 'Q') && param[1] == '=') {
+                    quality = rest_parse_qvalue(param + 2);
+                }
+            }
+            return quality;
+        }
+        range = end;
+    }
+    return -1;
+}
+
+/* True if the client accepts CBOR at least as readily as JSON. JSON stays the
+ * default, so "application/cbor;q=0", or JSON with a higher q, gets JSON. */
+static int rest_wants_cbor(httpd_req_t *req)
+{
+    char accept[ACCEPT_HDR_MAX];
+    esp_err_t err = httpd_req_get_hdr_value_str(req, "Accept", accept, sizeof(accept));
+    if (err != ESP_OK && err != ESP_ERR_HTTPD_RESULT_TRUNC) {
+        return 0;
+    }
+    int cbor_quality = rest_accept_quality(accept, CBOR_RESP_CONTENT_TYPE);
+    return cbor_quality > 0 && cbor_quality >= rest_accept_quality(accept, "application/json");
+}
+
+/* Report how long the response body took to encode, so the JSON and CBOR
+ * paths can be compared from the client side. `buf` has to stay valid until
+ * the response is sent. */
+static void rest_set_server_timing(httpd_req_t *req, char *buf, size_t size, int64_t start_us)
+{
+    int64_t elapsed_us = esp_timer_get_time() - start_us;
+    snprintf(buf, size, "enc;dur=%" PRId64 ".%03" PRId64, elapsed_us / 1000, elapsed_us % 1000);
+    httpd_resp_set_hdr(req, "Server-Timing", buf);
+}
+
+/* Render `root` into the scratch buffer and send it, freeing the tree. If
+ * `timing` is given, the Server-Timing header covers encoding up to here. */
+static esp_err_t rest_send_json(httpd_req_t *req, cJSON *root, char *timing, size_t timing_size, int64_t start_us)
+{
+    char *buf = ((rest_server_context_t *)(req->user_ctx))->scratch;
+    cJSON_bool printed = root && cJSON_PrintPreallocated(root, buf, SCRATCH_BUFSIZE, true);
+    cJSON_Delete(root);
+    if (!printed) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to encode response");
+        return ESP_FAIL;
+    }
+    if (timing) {
+        rest_set_server_timing(req, timing, timing_size, start_us);
+    }
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_sendstr(req, buf);
+}
+
 /* Simple handler for light brightness control */
 static esp_err_t light_brightness_post_handler(httpd_req_t *req)
 {
@@ -133,10 +332,19 @@ static esp_err_t light_brightness_post_handler(httpd_req_t *req)
     }
     buf[total_len] = '\0';
 
+    rest_json_reset();
     cJSON *root = cJSON_Parse(buf);
-    int red = cJSON_GetObjectItem(root, "red")->valueint;
-    int green = cJSON_GetObjectItem(root, "green")->valueint;
-    int blue = cJSON_GetObjectItem(root, "blue")->valueint;
+    cJSON *red_item = cJSON_GetObjectItem(root, "red");
+    cJSON *green_item = cJSON_GetObjectItem(root, "green");
+    cJSON *blue_item = cJSON_GetObjectItem(root, "blue");
+    if (!cJSON_IsNumber(red_item) || !cJSON_IsNumber(green_item) || !cJSON_IsNumber(blue_item)) {
+        cJSON_Delete(root);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "expected red, green and blue values");
+        return ESP_FAIL;
+    }
+    int red = red_item->valueint;
+    int green = green_item->valueint;
+    int blue = blue_item->valueint;
     ESP_LOGI(REST_TAG, "Light control: red = %d, green = %d, blue = %d", red, green, blue);
     cJSON_Delete(root);
     httpd_resp_sendstr(req, "Post control value successfully");
@@ -146,30 +354,53 @@ static esp_err_t light_brightness_post_handler(httpd_req_t *req)
 /* Simple handler for getting system handler */
 static esp_err_t system_info_get_handler(httpd_req_t *req)
 {
-    httpd_resp_set_type(req, "application/json");
-    cJSON *root = cJSON_CreateObject();
+    char timing[SERVER_TIMING_MAX];
     esp_chip_info_t chip_info;
     esp_chip_info(&chip_info);
+    int64_t start_us = esp_timer_get_time();
+    httpd_resp_set_hdr(req, "Vary", "Accept");
+
+    if (rest_wants_cbor(req)) {
+        cbor_resp_t enc;
+        cbor_resp_init(&enc, req, ((rest_server_context_t *)(req->user_ctx))->scratch, SCRATCH_BUFSIZE);
+        cbor_resp_map(&enc, 2);
+        cbor_resp_text(&enc, "version");
+        cbor_resp_text(&enc, IDF_VER);
+        cbor_resp_text(&enc, "cores");
+        cbor_resp_uint(&enc, chip_info.cores);
+        rest_set_server_timing(req, timing, sizeof(timing), start_us);
+        return cbor_resp_finish(&enc);
+    }
+
+    rest_json_reset();
+    cJSON *root = cJSON_CreateObject();
     cJSON_AddStringToObject(root, "version", IDF_VER);
     cJSON_AddNumberToObject(root, "cores", chip_info.cores);
-    const char *sys_info = cJSON_Print(root);
-    httpd_resp_sendstr(req, sys_info);
-    free((void *)sys_info);
-    cJSON_Delete(root);
-    return ESP_OK;
+    return rest_send_json(req, root, timing, sizeof(timing), start_us);
 }
 
 /* Simple handler for getting temperature data */
 static esp_err_t temperature_data_get_handler(httpd_req_t *req)
 {
-    httpd_resp_set_type(req, "application/json");
+    char timing[SERVER_TIMING_MAX];
+    int raw = esp_random() % 20;
+    int64_t start_us = esp_timer_get_time();
+    httpd_resp_set_hdr(req, "Vary", "Accept");
+
+    if (rest_wants_cbor(req)) {
+        cbor_resp_t enc;
+        cbor_resp_init(&enc, req, ((rest_server_context_t *)(req->user_ctx))->scratch, SCRATCH_BUFSIZE);
+        cbor_resp_map(&enc, 1);
+        cbor_resp_text(&enc, "raw");
+        cbor_resp_int(&enc, raw);
+        rest_set_server_timing(req, timing, sizeof(timing), start_us);
+        return cbor_resp_finish(&enc);
+    }
+
+    rest_json_reset();
     cJSON *root = cJSON_CreateObject();
-    cJSON_AddNumberToObject(root, "raw", esp_random() % 20);
-    const char *sys_info = cJSON_Print(root);
-    httpd_resp_sendstr(req, sys_info);
-    free((void *)sys_info);
-    cJSON_Delete(root);
-    return ESP_OK;
+    cJSON_AddNumberToObject(root, "raw", raw);
+    return rest_send_json(req, root, timing, sizeof(timing), start_us);
 }
 
 /* Simple handler for connecting to an access point */
@@ -195,13 +426,20 @@ static esp_err_t wifi_ap_connect_post_handler(httpd_req_t *req)
     }
     buf[total_len] = '\0';
 
+    rest_json_reset();
     cJSON *root = cJSON_Parse(buf);
-    char *ssid = cJSON_GetObjectItem(root, "ssid")->valuestring;
-    char *psk = cJSON_GetObjectItem(root, "psk")->valuestring;
-    ESP_LOGI(REST_TAG, "Wifi AP Connect: ssid = %s, psk = %s", ssid, psk);
-    cJSON_Delete(root);
+    char *ssid = cJSON_GetStringValue(cJSON_GetObjectItem(root, "ssid"));
+    char *psk = cJSON_GetStringValue(cJSON_GetObjectItem(root, "psk"));
+    if (ssid == NULL || psk == NULL) {
+        cJSON_Delete(root);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "expected ssid and psk values");
+        return ESP_FAIL;
+    }
+    /* The psk is never logged; it must not reach the console in the clear */
+    ESP_LOGI(REST_TAG, "Wifi AP Connect: ssid = %s", ssid);
     httpd_resp_sendstr(req, "Post control value successfully");
-    ESP_LOGE(REST_TAG, "TODO: Unhandled request to connect to ssid %s psk %s", ssid, psk);
+    ESP_LOGE(REST_TAG, "TODO: Unhandled request to connect to ssid %s", ssid);
+    cJSON_Delete(root);
     return ESP_OK;
 }
 
@@ -210,20 +448,60 @@ static esp_err_t wifi_ap_get_handler(httpd_req_t *req)
 {
     ESP_ERROR_CHECK(wifi_enable_scanning());
 
+    // Kept in the server context rather than on the httpd task's stack
+    wifi_ap_record_t *ap_info = ((rest_server_context_t *)(req->user_ctx))->ap_info;
     uint16_t number = DEFAULT_SCAN_LIST_SIZE;
-    wifi_ap_record_t ap_info[DEFAULT_SCAN_LIST_SIZE];
     uint16_t ap_count = 0;
-    memset(ap_info, 0, sizeof(ap_info));
+    memset(ap_info, 0, sizeof(wifi_ap_record_t) * DEFAULT_SCAN_LIST_SIZE);
 
     ESP_ERROR_CHECK(esp_wifi_scan_get_ap_records(&number, ap_info));
     ESP_ERROR_CHECK(esp_wifi_scan_get_ap_num(&ap_count));
     ESP_LOGI(REST_TAG, "Total APs scanned = %u, actual AP number ap_info holds = %u", ap_count, number);
 
-    httpd_resp_set_type(req, "application/json");
+    char timing[SERVER_TIMING_MAX];
+    int64_t start_us = esp_timer_get_time();
+    httpd_resp_set_hdr(req, "Vary", "Accept");
+
+    if (rest_wants_cbor(req)) {
+        // Same unpopulated-entry rule as below, counted first because CBOR
+        // arrays carry their length up front
+        int valid = 0;
+        while (valid < number && ap_info[valid].rssi != 0) {
+            valid++;
+        }
+        cbor_resp_t enc;
+        cbor_resp_init(&enc, req, ((rest_server_context_t *)(req->user_ctx))->scratch, SCRATCH_BUFSIZE);
+        cbor_resp_map(&enc, 3);
+        cbor_resp_text(&enc, "total_networks");
+        cbor_resp_uint(&enc, ap_count);
+        cbor_resp_text(&enc, "returned_networks");
+        cbor_resp_uint(&enc, number);
+        cbor_resp_text(&enc, "networks");
+        cbor_resp_array(&enc, valid);
+        for (int i = 0; i < valid; i++) {
+            // BSSIDs go out as their raw 6 bytes rather than formatted text
+            cbor_resp_map(&enc, 3);
+            cbor_resp_text(&enc, "ssid");
+            cbor_resp_text(&enc, (const char *)ap_info[i].ssid);
+            cbor_resp_text(&enc, "bssid");
+            cbor_resp_bytes(&enc, ap_info[i].bssid, sizeof(ap_info[i].bssid));
+            cbor_resp_text(&enc, "rssi");
+            cbor_resp_int(&enc, ap_info[i].rssi);
+        }
+        if (cbor_resp_unsent(&enc)) {
+            rest_set_server_timing(req, timing, sizeof(timing), start_us);
+        }
+        return cbor_resp_finish(&enc);
+    }
+
+    rest_json_reset();
+    cJSON *networks = NULL;
     cJSON *root = cJSON_CreateObject();
-    cJSON_AddNumberToObject(root, "total_networks", ap_count);
-    cJSON_AddNumberToObject(root, "returned_networks", number);
-    cJSON *networks = cJSON_AddArrayToObject(root, "networks");
+    REST_CHECK(root
+               && cJSON_AddNumberToObject(root, "total_networks", ap_count)
+               && cJSON_AddNumberToObject(root, "returned_networks", number)
+               && (networks = cJSON_AddArrayToObject(root, "networks")),
+               "No memory for scan response", err);
     // Because we zero-out the array before starting, we can
     // assume that 0-rssi entries are unpopulated
     for(int i = 0; i < number && ap_info[i].rssi != 0; i++) {
@@ -232,32 +510,416 @@ static esp_err_t wifi_ap_get_handler(httpd_req_t *req)
             "%02X:%02X:%02X:%02X:%02X:%02X",
             ap_info[i].bssid[0], ap_info[i].bssid[1], ap_info[i].bssid[2],
             ap_info[i].bssid[3], ap_info[i].bssid[4], ap_info[i].bssid[5]);
+        // Added to the array first, so it's freed with the tree on failure
         cJSON *ap = cJSON_CreateObject();
-        cJSON_AddStringToObject(ap, "ssid", (char *)ap_info[i].ssid);
-        cJSON_AddStringToObject(ap, "bssid", (char *)bssid_str);
-        cJSON_AddNumberToObject(ap, "rssi", ap_info[i].rssi);
-        cJSON_InsertItemInArray(networks, i, ap);
-    }
-    const char *ap_info_resp = cJSON_Print(root);
-    httpd_resp_sendstr(req, ap_info_resp);
-    free((void *)ap_info_resp);
+        REST_CHECK(ap && cJSON_AddItemToArray(networks, ap)
+                   && cJSON_AddStringToObject(ap, "ssid", (char *)ap_info[i].ssid)
+                   && cJSON_AddStringToObject(ap, "bssid", (char *)bssid_str)
+                   && cJSON_AddNumberToObject(ap, "rssi", ap_info[i].rssi),
+                   "No memory for scan entry %d", err, i);
+    }
+    return rest_send_json(req, root, timing, sizeof(timing), start_us);
+err:
+    // Better no answer than a networks array shorter than returned_networks
     cJSON_Delete(root);
+    httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to encode response");
+    return ESP_FAIL;
+}
+
+#if CONFIG_APP_OTA
+/* Reject the request with a 401 unless it carries the update token. The
+ * comparison takes the same time however much of the token matches. */
+static esp_err_t ota_check_token(httpd_req_t *req)
+{
+    char token[sizeof(CONFIG_APP_OTA_TOKEN)] = {0};
+    if (httpd_req_get_hdr_value_str(req, OTA_TOKEN_HDR, token, sizeof(token)) != ESP_OK
+        || mbedtls_ct_memcmp(token, CONFIG_APP_OTA_TOKEN, sizeof(token)) != 0) {
+        ESP_LOGW(REST_TAG, "Rejected update to %s without a valid " OTA_TOKEN_HDR, req->uri);
+        httpd_resp_send_err(req, HTTPD_401_UNAUTHORIZED, "missing or wrong " OTA_TOKEN_HDR " header");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+/* Parse the optional expected-digest header. Returns ESP_ERR_NOT_FOUND if the
+ * client didn't send one, ESP_ERR_INVALID_ARG if it's malformed. */
+static esp_err_t ota_get_expected_sha256(httpd_req_t *req, uint8_t digest[OTA_SHA256_LEN])
+{
+    char hex[OTA_SHA256_LEN * 2 + 1] = {0};
+    if (httpd_req_get_hdr_value_len(req, OTA_SHA256_HDR) == 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (httpd_req_get_hdr_value_str(req, OTA_SHA256_HDR, hex, sizeof(hex)) != ESP_OK
+        || strlen(hex) != sizeof(hex) - 1) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (int i = 0; i < OTA_SHA256_LEN; i++) {
+        unsigned int byte;
+        if (sscanf(&hex[i * 2], "%2x", &byte) != 1) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        digest[i] = (uint8_t)byte;
+    }
+    return ESP_OK;
+}
+
+/* Destination for streamed upload data; called once per received chunk */
+typedef esp_err_t (*ota_sink_fn)(void *sink_ctx, size_t offset, const char *data, size_t len);
+
+/* Feed the request body to `sink` as httpd_req_recv delivers it, hashing each
+ * chunk on the way through, so that no more than one scratch buffer of the
+ * image is ever held in RAM. */
+static esp_err_t ota_stream_body(httpd_req_t *req, ota_sink_fn sink, void *sink_ctx,
+                                 uint8_t digest[OTA_SHA256_LEN])
+{
+    char *buf = ((rest_server_context_t *)(req->user_ctx))->scratch;
+    size_t remaining = req->content_len;
+    size_t offset = 0;
+    int timeouts = 0;
+    esp_err_t err = ESP_OK;
+
+    mbedtls_sha256_context sha;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+    while (remaining > 0) {
+        int received = httpd_req_recv(req, buf, MIN(remaining, SCRATCH_BUFSIZE));
+        if (received == HTTPD_SOCK_ERR_TIMEOUT && ++timeouts < OTA_RECV_MAX_TIMEOUTS) {
+            continue;
+        }
+        if (received <= 0) {
+            ESP_LOGE(REST_TAG, "Upload interrupted after %u bytes", offset);
+            err = ESP_FAIL;
+            break;
+        }
+        timeouts = 0;
+        mbedtls_sha256_update(&sha, (const unsigned char *)buf, received);
+        err = sink(sink_ctx, offset, buf, received);
+        if (err != ESP_OK) {
+            ESP_LOGE(REST_TAG, "Failed to write upload at offset %u (%s)", offset, esp_err_to_name(err));
+            break;
+        }
+        offset += received;
+        remaining -= received;
+    }
+    mbedtls_sha256_finish(&sha, digest);
+    mbedtls_sha256_free(&sha);
+    return err;
+}
+
+/* Respond with the size and throughput of a completed upload */
+static esp_err_t ota_send_result(httpd_req_t *req, const esp_partition_t *part, int64_t start_us)
+{
+    int64_t elapsed_us = esp_timer_get_time() - start_us;
+    double kib_per_sec = elapsed_us > 0 ? (req->content_len * 1000.0) / (elapsed_us * 1.024) : 0;
+    ESP_LOGI(REST_TAG, "Wrote %u bytes to partition %s in %lld ms (%.1f KiB/s)",
+             req->content_len, part->label, elapsed_us / 1000, kib_per_sec);
+
+    rest_json_reset();
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddStringToObject(root, "partition", part->label);
+    cJSON_AddNumberToObject(root, "bytes", req->content_len);
+    cJSON_AddNumberToObject(root, "elapsed_ms", elapsed_us / 1000);
+    cJSON_AddNumberToObject(root, "kib_per_sec", kib_per_sec);
+    return rest_send_json(req, root, NULL, 0, 0);
+}
+
+static esp_err_t ota_firmware_write(void *sink_ctx, size_t offset, const char *data, size_t len)
+{
+    return esp_ota_write(*(esp_ota_handle_t *)sink_ctx, data, len);
+}
+
+/* Handler for streaming a new application image into the inactive OTA slot */
+static esp_err_t ota_firmware_post_handler(httpd_req_t *req)
+{
+    int64_t start_us = esp_timer_get_time();
+    if (ota_check_token(req) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    uint8_t expected[OTA_SHA256_LEN];
+    uint8_t actual[OTA_SHA256_LEN];
+    esp_err_t sha_err = ota_get_expected_sha256(req, expected);
+    if (sha_err == ESP_ERR_INVALID_ARG) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "malformed " OTA_SHA256_HDR " header");
+        return ESP_FAIL;
+    }
+
+    const esp_partition_t *part = esp_ota_get_next_update_partition(NULL);
+    if (part == NULL) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "no OTA partition available");
+        return ESP_FAIL;
+    }
+    if (req->content_len == 0 || req->content_len > part->size) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "image size doesn't fit the OTA partition");
+        return ESP_FAIL;
+    }
+    ESP_LOGI(REST_TAG, "Firmware update: %u bytes to partition %s at 0x%" PRIx32,
+             req->content_len, part->label, part->address);
+
+    /* Sequential writes erase the slot sector by sector just ahead of the data */
+    esp_ota_handle_t ota_handle;
+    if (esp_ota_begin(part, OTA_WITH_SEQUENTIAL_WRITES, &ota_handle) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to start firmware update");
+        return ESP_FAIL;
+    }
+    if (ota_stream_body(req, ota_firmware_write, &ota_handle, actual) != ESP_OK) {
+        esp_ota_abort(ota_handle);
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to write firmware image");
+        return ESP_FAIL;
+    }
+    if (sha_err == ESP_OK && memcmp(expected, actual, sizeof(actual)) != 0) {
+        esp_ota_abort(ota_handle);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "firmware image SHA-256 mismatch");
+        return ESP_FAIL;
+    }
+    /* esp_ota_end() also validates the image header and its embedded digest */
+    if (esp_ota_end(ota_handle) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "firmware image failed validation");
+        return ESP_FAIL;
+    }
+    if (esp_ota_set_boot_partition(part) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to select new boot partition");
+        return ESP_FAIL;
+    }
+
+    ota_send_result(req, part, start_us);
+    ESP_LOGI(REST_TAG, "Firmware update complete, restarting");
+    vTaskDelay(pdMS_TO_TICKS(500));
+    esp_restart();
+    return ESP_OK;
+}
+
+static esp_err_t ota_www_write(void *sink_ctx, size_t offset, const char *data, size_t len)
+{
+    const esp_partition_t *part = (const esp_partition_t *)sink_ctx;
+    /* Erase every sector that starts inside this chunk; the sector holding
+     * `offset` itself was already erased along with the previous chunk. */
+    size_t erase_start = (offset + SPI_FLASH_SEC_SIZE - 1) & ~(SPI_FLASH_SEC_SIZE - 1);
+    size_t erase_end = (offset + len + SPI_FLASH_SEC_SIZE - 1) & ~(SPI_FLASH_SEC_SIZE - 1);
+    if (erase_end > erase_start) {
+        esp_err_t err = esp_partition_erase_range(part, erase_start, erase_end - erase_start);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+    return esp_partition_write(part, offset, data, len);
+}
+
+/* Handler for replacing the web asset (SPIFFS) partition in place */
+static esp_err_t ota_www_post_handler(httpd_req_t *req)
+{
+    int64_t start_us = esp_timer_get_time();
+    if (ota_check_token(req) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    uint8_t expected[OTA_SHA256_LEN];
+    uint8_t actual[OTA_SHA256_LEN];
+    esp_err_t sha_err = ota_get_expected_sha256(req, expected);
+    if (sha_err == ESP_ERR_INVALID_ARG) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "malformed " OTA_SHA256_HDR " header");
+        return ESP_FAIL;
+    }
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           ESP_PARTITION_SUBTYPE_DATA_SPIFFS,
+                                                           OTA_WWW_PARTITION_LABEL);
+    if (part == NULL) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "no www partition available");
+        return ESP_FAIL;
+    }
+    if (req->content_len == 0 || req->content_len > part->size) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "image size doesn't fit the www partition");
+        return ESP_FAIL;
+    }
+    ESP_LOGI(REST_TAG, "www update: %u bytes to partition %s at 0x%" PRIx32,
+             req->content_len, part->label, part->address);
+
+    /* There's no second copy to fall back to, so the filesystem has to come
+     * down while it's being overwritten. A failed upload, or a reset part way
+     * through, leaves it unmountable; app_main() then starts the API without
+     * the web interface, so a good image can still be pushed here. */
+    esp_vfs_spiffs_unregister(NULL);
+    if (ota_stream_body(req, ota_www_write, (void *)part, actual) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to write www image");
+        return ESP_FAIL;
+    }
+    if (sha_err == ESP_OK && memcmp(expected, actual, sizeof(actual)) != 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "www image SHA-256 mismatch");
+        return ESP_FAIL;
+    }
+    /* Clear anything left over from a larger previous image */
+    size_t tail = (req->content_len + SPI_FLASH_SEC_SIZE - 1) & ~(SPI_FLASH_SEC_SIZE - 1);
+    if (tail < part->size && esp_partition_erase_range(part, tail, part->size - tail) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to erase www partition tail");
+        return ESP_FAIL;
+    }
+    /* Only report success once the new image mounts and has a front page */
+    if (init_fs() != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to mount new www image");
+        return ESP_FAIL;
+    }
+    char index_path[FILE_PATH_MAX];
+    struct stat index_stat;
+    snprintf(index_path, sizeof(index_path), "%s/index.html",
+             ((rest_server_context_t *)(req->user_ctx))->base_path);
+    if (stat(index_path, &index_stat) != 0) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "www image has no index.html");
+        return ESP_FAIL;
+    }
+    return ota_send_result(req, part, start_us);
+}
+#endif
+
+#if CONFIG_APP_HEAP_AUDIT
+/* Start recording every heap allocation, for front/backend-test/heap_audit.py */
+static esp_err_t heap_audit_start_post_handler(httpd_req_t *req)
+{
+    if (heap_trace_start(HEAP_TRACE_ALL) != ESP_OK) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Failed to start heap tracing");
+        return ESP_FAIL;
+    }
+    httpd_resp_sendstr(req, "Heap tracing started");
     return ESP_OK;
 }
 
+/* Stop recording and stream out each allocation's size and callers. This is
+ * written by hand, chunk by chunk, so reporting doesn't itself need a heap. */
+static esp_err_t heap_audit_stop_post_handler(httpd_req_t *req)
+{
+    char *buf = ((rest_server_context_t *)(req->user_ctx))->scratch;
+    heap_trace_summary_t summary = {0};
+    heap_trace_stop();
+    heap_trace_summary(&summary);
+
+    httpd_resp_set_type(req, "application/json");
+    snprintf(buf, SCRATCH_BUFSIZE, "{\"total_allocations\":%u,\"overflowed\":%s,\"records\":[",
+             summary.total_allocations, summary.has_overflowed ? "true" : "false");
+    httpd_resp_sendstr_chunk(req, buf);
+    for (size_t i = 0; i < heap_trace_get_count(); i++) {
+        heap_trace_record_t record;
+        if (heap_trace_get(i, &record) != ESP_OK) {
+            break;
+        }
+        int len = snprintf(buf, SCRATCH_BUFSIZE, "%s{\"size\":%u,\"alloced_by\":[", i ? "," : "", record.size);
+        for (int depth = 0; depth < CONFIG_HEAP_TRACING_STACK_DEPTH; depth++) {
+            len += snprintf(buf + len, SCRATCH_BUFSIZE - len, "%s\"%p\"", depth ? "," : "", record.alloced_by[depth]);
+        }
+        snprintf(buf + len, SCRATCH_BUFSIZE - len, "]}");
+        httpd_resp_sendstr_chunk(req, buf);
+    }
+    httpd_resp_sendstr_chunk(req, "]}");
+    return httpd_resp_sendstr_chunk(req, NULL);
+}
+#endif
+
+#if CONFIG_APP_HTTPS
+/* Called by mbedtls once it has parsed the ClientHello, which is the earliest
+ * point in the handshake we can hook. By then the session ticket extension
+ * has been checked, so mbedtls already knows whether it's resuming. Leaves
+ * certificate selection alone. */
+static int tls_handshake_start_cb(mbedtls_ssl_context *ssl)
+{
+    s_tls_handshake_start_us = esp_timer_get_time();
+    s_tls_handshake_resumed = ssl->MBEDTLS_PRIVATE(handshake)->resume;
+    return 0;
+}
+
+static void tls_handshake_record(tls_handshake_stats_t *stats, int64_t elapsed_us)
+{
+    stats->count++;
+    stats->total_us += elapsed_us;
+    if (elapsed_us > stats->max_us) {
+        stats->max_us = elapsed_us;
+    }
+}
+
+/* Called when a TLS session has been established (and closed) */
+static void tls_session_cb(esp_https_server_user_cb_arg_t *user_cb)
+{
+    if (user_cb->user_cb_state != HTTPD_SSL_USER_CB_SESS_CREATE) {
+        return;
+    }
+    int64_t elapsed_us = esp_timer_get_time() - s_tls_handshake_start_us;
+    tls_handshake_record(s_tls_handshake_resumed ? &s_tls_resumed : &s_tls_full, elapsed_us);
+    ESP_LOGD(REST_TAG, "%s TLS handshake in %lld ms", s_tls_handshake_resumed ? "Resumed" : "Full",
+             elapsed_us / 1000);
+}
+
+static void tls_stats_add(cJSON *root, const char *name, const tls_handshake_stats_t *stats)
+{
+    cJSON *item = cJSON_AddObjectToObject(root, name);
+    cJSON_AddNumberToObject(item, "count", stats->count);
+    cJSON_AddNumberToObject(item, "mean_ms", stats->count ? stats->total_us / stats->count / 1000 : 0);
+    cJSON_AddNumberToObject(item, "max_ms", stats->max_us / 1000);
+}
+
+/* Handler for reporting TLS handshake counts and timings */
+static esp_err_t tls_stats_get_handler(httpd_req_t *req)
+{
+    rest_json_reset();
+    cJSON *root = cJSON_CreateObject();
+    tls_stats_add(root, "full", &s_tls_full);
+    tls_stats_add(root, "resumed", &s_tls_resumed);
+    return rest_send_json(req, root, NULL, 0, 0);
+}
+#endif
+
 esp_err_t start_rest_server(const char *base_path)
 {
     REST_CHECK(base_path, "wrong base path", err);
+#if CONFIG_APP_STATIC_ALLOCATION
+    rest_server_context_t *rest_context = &s_rest_context;
+    cJSON_Hooks json_hooks = {
+        .malloc_fn = json_pool_malloc,
+        .free_fn = json_pool_free
+    };
+    cJSON_InitHooks(&json_hooks);
+    ESP_LOGI(REST_TAG, "Static RAM: rest context %u bytes, cJSON pool %u bytes",
+             sizeof(s_rest_context), sizeof(s_json_pool));
+#else
     rest_server_context_t *rest_context = calloc(1, sizeof(rest_server_context_t));
     REST_CHECK(rest_context, "No memory for rest context", err);
+#endif
     strlcpy(rest_context->base_path, base_path, sizeof(rest_context->base_path));
 
+#if CONFIG_APP_HEAP_AUDIT
+    REST_CHECK(heap_trace_init_standalone(s_heap_records, CONFIG_APP_HEAP_AUDIT_RECORDS) == ESP_OK,
+               "Heap trace init failed", err_start);
+#endif
+
     httpd_handle_t server = NULL;
-    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.uri_match_fn = httpd_uri_match_wildcard;
+#if CONFIG_APP_HTTPS
+    httpd_ssl_config_t ssl_config = HTTPD_SSL_CONFIG_DEFAULT();
+    httpd_config_t *config = &ssl_config.httpd;
+#else
+    httpd_config_t http_config = HTTPD_DEFAULT_CONFIG();
+    httpd_config_t *config = &http_config;
+#endif
+    config->uri_match_fn = httpd_uri_match_wildcard;
+    config->max_uri_handlers = 12;
 
+#if CONFIG_APP_HTTPS
+    ssl_config.servercert = servercert_pem_start;
+    ssl_config.servercert_len = servercert_pem_end - servercert_pem_start;
+    ssl_config.prvtkey_pem = prvtkey_pem_start;
+    ssl_config.prvtkey_len = prvtkey_pem_end - prvtkey_pem_start;
+    ssl_config.session_tickets = true;
+    ssl_config.user_cb = tls_session_cb;
+    ssl_config.cert_select_cb = tls_handshake_start_cb;
+    /* Handshakes are the expensive part, so keep connections open for reuse:
+     * evict the least recently used one when a new client arrives instead of
+     * refusing it, and reap peers that vanished without closing. */
+    config->lru_purge_enable = true;
+    config->keep_alive_enable = true;
+    config->keep_alive_idle = CONFIG_APP_HTTPS_KEEP_ALIVE_IDLE;
+    config->keep_alive_interval = CONFIG_APP_HTTPS_KEEP_ALIVE_INTERVAL;
+    config->keep_alive_count = CONFIG_APP_HTTPS_KEEP_ALIVE_COUNT;
+
+    ESP_LOGI(REST_TAG, "Starting HTTPS Server");
+    REST_CHECK(httpd_ssl_start(&server, &ssl_config) == ESP_OK, "Start server failed", err_start);
+#else
     ESP_LOGI(REST_TAG, "Starting HTTP Server");
-    REST_CHECK(httpd_start(&server, &config) == ESP_OK, "Start server failed", err_start);
+    REST_CHECK(httpd_start(&server, config) == ESP_OK, "Start server failed", err_start);
+#endif
 
     /* URI handler for provisioning device to a wifi network*/
     httpd_uri_t wifi_ap_connect_post_uri = {
@@ -304,6 +966,56 @@ esp_err_t start_rest_server(const char *base_path)
     };
     httpd_register_uri_handler(server, &light_brightness_post_uri);
 
+#if CONFIG_APP_OTA
+    /* URI handler for streaming a firmware update into the next OTA slot */
+    httpd_uri_t ota_firmware_post_uri = {
+        .uri = "/api/v1/system/ota",
+        .method = HTTP_POST,
+        .handler = ota_firmware_post_handler,
+        .user_ctx = rest_context
+    };
+    httpd_register_uri_handler(server, &ota_firmware_post_uri);
+
+    /* URI handler for replacing the web asset partition */
+    httpd_uri_t ota_www_post_uri = {
+        .uri = "/api/v1/system/ota/www",
+        .method = HTTP_POST,
+        .handler = ota_www_post_handler,
+        .user_ctx = rest_context
+    };
+    httpd_register_uri_handler(server, &ota_www_post_uri);
+#endif
+
+#if CONFIG_APP_HTTPS
+    /* URI handler for fetching TLS handshake statistics */
+    httpd_uri_t tls_stats_get_uri = {
+        .uri = "/api/v1/system/tls",
+        .method = HTTP_GET,
+        .handler = tls_stats_get_handler,
+        .user_ctx = rest_context
+    };
+    httpd_register_uri_handler(server, &tls_stats_get_uri);
+#endif
+
+#if CONFIG_APP_HEAP_AUDIT
+    /* URI handlers for recording heap allocations across a request mix */
+    httpd_uri_t heap_audit_start_post_uri = {
+        .uri = "/api/v1/debug/heap/start",
+        .method = HTTP_POST,
+        .handler = heap_audit_start_post_handler,
+        .user_ctx = rest_context
+    };
+    httpd_register_uri_handler(server, &heap_audit_start_post_uri);
+
+    httpd_uri_t heap_audit_stop_post_uri = {
+        .uri = "/api/v1/debug/heap/stop",
+        .method = HTTP_POST,
+        .handler = heap_audit_stop_post_handler,
+        .user_ctx = rest_context
+    };
+    httpd_register_uri_handler(server, &heap_audit_stop_post_uri);
+#endif
+
     /* URI handler for getting web server files */
     httpd_uri_t common_get_uri = {
         .uri = "/*",
@@ -315,7 +1027,9 @@ esp_err_t start_rest_server(const char *base_path)
 
     return ESP_OK;
 err_start:
+#if !CONFIG_APP_STATIC_ALLOCATION
     free(rest_context);
+#endif
 err:
     return ESP_FAIL;
 }
@@ -0,0 +1,24 @@
+# Fail the build if the files packed into the www partition add up to more
+# than CONFIG_WEB_ASSET_BUDGET.
+#
+# Usage: cmake -DWEB_DIST_DIR=<dir> -DWEB_BUDGET=<bytes>
+#              [-DWEB_BUDGET_SETTING=<where the budget is set>] -P web_budget.cmake
+if(NOT WEB_DIST_DIR OR NOT WEB_BUDGET)
+    message(FATAL_ERROR "WEB_DIST_DIR and WEB_BUDGET must both be set")
+endif()
+if(NOT WEB_BUDGET_SETTING)
+    set(WEB_BUDGET_SETTING "CONFIG_WEB_ASSET_BUDGET")
+endif()
+
+file(GLOB_RECURSE web_files RELATIVE ${WEB_DIST_DIR} "${WEB_DIST_DIR}/*")
+set(total 0)
+foreach(web_file ${web_files})
+    file(SIZE "${WEB_DIST_DIR}/${web_file}" size)
+    math(EXPR total "${total} + ${size}")
+endforeach()
+
+if(total GREATER WEB_BUDGET)
+    message(FATAL_ERROR "Web interface is ${total} bytes, over its ${WEB_BUDGET} byte budget "
+                        "(${WEB_BUDGET_SETTING}). Trim ${WEB_DIST_DIR} or raise the budget.")
+endif()
+message(STATUS "Web interface is ${total} of ${WEB_BUDGET} budgeted bytes")
@@ -64,6 +64,14 @@ static const char *TAG = "wifi";
 /* FreeRTOS event group to signal when we are connected*/
 static EventGroupHandle_t s_wifi_event_group;
 
+#define SMARTCONFIG_TASK_STACK_SIZE 4096
+static TaskHandle_t s_smartconfig_task = NULL;
+#if CONFIG_APP_STATIC_ALLOCATION
+static StaticEventGroup_t s_wifi_event_group_buf;
+static StackType_t s_smartconfig_stack[SMARTCONFIG_TASK_STACK_SIZE];
+static StaticTask_t s_smartconfig_tcb;
+#endif
+
 /* The event group allows multiple bits for each event, but we only care about two events:
  * - we are connected to the AP with an IP
  * - we failed to connect after the maximum amount of retries */
@@ -89,16 +97,32 @@ static void smartconfig_task(void * parm)
         if(uxBits & WIFI_SC_DONE_BIT) {
             ESP_LOGI(TAG, "smartconfig over");
             esp_smartconfig_stop();
+            s_smartconfig_task = NULL;
             vTaskDelete(NULL);
         }
     }
 }
 
+// Only one smartconfig session at a time; with static allocation there's
+// only the one stack to run it on
+static void smartconfig_task_start(void)
+{
+    if (s_smartconfig_task != NULL) {
+        return;
+    }
+#if CONFIG_APP_STATIC_ALLOCATION
+    s_smartconfig_task = xTaskCreateStatic(smartconfig_task, "smartconfig_task", SMARTCONFIG_TASK_STACK_SIZE,
+                                           NULL, 3, s_smartconfig_stack, &s_smartconfig_tcb);
+#else
+    xTaskCreate(smartconfig_task, "smartconfig_task", SMARTCONFIG_TASK_STACK_SIZE, NULL, 3, &s_smartconfig_task);
+#endif
+}
+
 static void sta_handle_wifi_event(int32_t event_id, void* event_data)
 {
     if (event_id == WIFI_EVENT_STA_START) {
         esp_wifi_connect();
-        xTaskCreate(smartconfig_task, "smartconfig_task", 4096, NULL, 3, NULL);
+        smartconfig_task_start();
     } else if (event_id == WIFI_EVENT_STA_DISCONNECTED) {
         xEventGroupClearBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
         if (s_retry_num < ESP_STA_MAXIMUM_RETRY) {
@@ -153,7 +177,11 @@ static void sta_event_handler(void* arg, esp_event_base_t event_base,
 
 esp_err_t wifi_sta_init(void)
 {
+#if CONFIG_APP_STATIC_ALLOCATION
+    s_wifi_event_group = xEventGroupCreateStatic(&s_wifi_event_group_buf);
+#else
     s_wifi_event_group = xEventGroupCreate();
+#endif
 
     // Handled in app_main()
     //ESP_ERROR_CHECK(esp_netif_init());